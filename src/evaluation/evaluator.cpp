@@ -0,0 +1,140 @@
+#include "evaluation/evaluator.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+
+Evaluator::Evaluator(const std::vector<Eigen::VectorXf>& samples, const std::vector<int>& labels, int numClasses,
+                     size_t batchSize, size_t numThreads, size_t topK)
+    : labels(labels), numClasses(numClasses), batchSize(batchSize), numThreads(numThreads), topK(topK)
+{
+    if (samples.empty() || samples.size() != labels.size())
+    {
+        throw std::invalid_argument("Evaluator needs as many labels as samples");
+    }
+    if (batchSize == 0)
+    {
+        throw std::invalid_argument("Batch size must be positive");
+    }
+    if (numClasses <= 0)
+    {
+        throw std::invalid_argument("Number of classes must be positive");
+    }
+    if (topK == 0)
+    {
+        throw std::invalid_argument("Top-k must be positive");
+    }
+    for (int label : labels)
+    {
+        if (label < 0 || label >= numClasses)
+        {
+            throw std::invalid_argument("Label out of range");
+        }
+    }
+
+    inputs.resize(samples[0].size(), samples.size());
+    for (size_t i = 0; i < samples.size(); ++i)
+    {
+        if (samples[i].size() != inputs.rows())
+        {
+            throw std::invalid_argument("Sample size mismatch");
+        }
+        inputs.col(i) = samples[i];
+    }
+
+    if (this->numThreads == 0)
+    {
+        this->numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+void Evaluator::evaluateRange(const MLP& mlp, size_t firstBatch, size_t batchStride, EvaluationMetrics& partial, std::vector<int>& predictions) const
+{
+    // Same clipping as CrossEntropy::loss
+    const float epsilon = 1e-7f;
+    const size_t sampleCount = labels.size();
+    std::vector<Eigen::MatrixXf> workspace;
+
+    for (size_t start = firstBatch * batchSize; start < sampleCount; start += batchStride * batchSize)
+    {
+        size_t count = std::min(batchSize, sampleCount - start);
+        const Eigen::MatrixXf& outputs = mlp.forwardBatch(inputs.middleCols(start, count), workspace);
+
+        for (size_t c = 0; c < count; ++c)
+        {
+            int actual = labels[start + c];
+            Eigen::Index predicted;
+            outputs.col(c).maxCoeff(&predicted);
+
+            // The label is in the top k if fewer than k classes score strictly higher
+            float actualScore = outputs(actual, c);
+            size_t higher = (outputs.col(c).array() > actualScore).count();
+
+            float clipped = std::min(std::max(actualScore, epsilon), 1.0f - epsilon);
+            partial.totalLoss += -std::log(clipped) / numClasses;
+
+            partial.correct += (predicted == actual);
+            partial.topKCorrect += (higher < topK);
+            partial.confusionMatrix(actual, predicted)++;
+            predictions[start + c] = static_cast<int>(predicted);
+        }
+        partial.sampleCount += count;
+    }
+}
+
+EvaluationMetrics Evaluator::evaluate(const MLP& mlp) const
+{
+    const size_t batchCount = (labels.size() + batchSize - 1) / batchSize;
+    const size_t threadCount = std::min(numThreads, batchCount);
+
+    // Check the output size on one sample before the workers index the confusion matrix with it
+    // (activation layers only know their output size after a forward pass)
+    std::vector<Eigen::MatrixXf> probeWorkspace;
+    if (mlp.forwardBatch(inputs.leftCols(1), probeWorkspace).rows() != numClasses)
+    {
+        throw std::invalid_argument("Network output size does not match the number of classes");
+    }
+
+    EvaluationMetrics result;
+    result.predictions.resize(labels.size());
+
+    // Each thread takes every threadCount-th batch and accumulates into its own partial sums
+    std::vector<EvaluationMetrics> partials(threadCount);
+    for (auto& partial : partials)
+    {
+        partial.confusionMatrix = Eigen::MatrixXi::Zero(numClasses, numClasses);
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount - 1);
+    for (size_t t = 1; t < threadCount; ++t)
+    {
+        workers.emplace_back([&, t]() { evaluateRange(mlp, t, threadCount, partials[t], result.predictions); });
+    }
+    evaluateRange(mlp, 0, threadCount, partials[0], result.predictions);
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    // Merge partial sums
+    result.confusionMatrix = Eigen::MatrixXi::Zero(numClasses, numClasses);
+    for (const auto& partial : partials)
+    {
+        result.sampleCount += partial.sampleCount;
+        result.correct += partial.correct;
+        result.topKCorrect += partial.topKCorrect;
+        result.totalLoss += partial.totalLoss;
+        result.confusionMatrix += partial.confusionMatrix;
+    }
+
+    return result;
+}
+
+std::future<EvaluationMetrics> Evaluator::evaluateAsync(const MLP& mlp) const
+{
+    return std::async(std::launch::async, [this, snapshot = mlp.clone()]()
+    {
+        return evaluate(snapshot);
+    });
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "mlp/mlp.hpp"
+#include <Eigen/Dense>
+#include <future>
+#include <vector>
+
+struct EvaluationMetrics
+{
+    size_t sampleCount = 0;
+    size_t correct = 0;
+    size_t topKCorrect = 0;
+    double totalLoss = 0.0;
+
+    // Rows are the actual class, columns the predicted class
+    Eigen::MatrixXi confusionMatrix;
+
+    // Predicted class for every sample, in dataset order
+    std::vector<int> predictions;
+
+    float accuracy() const { return sampleCount ? static_cast<float>(correct) / sampleCount : 0.0f; }
+    float topKAccuracy() const { return sampleCount ? static_cast<float>(topKCorrect) / sampleCount : 0.0f; }
+    float averageLoss() const { return sampleCount ? static_cast<float>(totalLoss / sampleCount) : 0.0f; }
+};
+
+// Runs a classification dataset through an MLP in batches spread over several threads
+class Evaluator
+{
+private:
+    Eigen::MatrixXf inputs; // One sample per column, packed once at construction
+    std::vector<int> labels;
+    int numClasses;
+    size_t batchSize;
+    size_t numThreads;
+    size_t topK;
+
+    void evaluateRange(const MLP& mlp, size_t firstBatch, size_t batchStride, EvaluationMetrics& partial, std::vector<int>& predictions) const;
+
+public:
+    /// @brief Packs the dataset into a single matrix so batches can be sliced without copies
+    /// @param samples Input vectors, all of the same size
+    /// @param labels Class index of each sample
+    /// @param numClasses Number of output classes
+    /// @param batchSize Number of samples per forward pass
+    /// @param numThreads Number of worker threads (0 to use the hardware concurrency)
+    /// @param topK K used for the top-k accuracy
+    Evaluator(const std::vector<Eigen::VectorXf>& samples, const std::vector<int>& labels, int numClasses,
+              size_t batchSize = 512, size_t numThreads = 0, size_t topK = 3);
+
+    /// @brief Evaluates the network on the whole dataset
+    /// @param mlp Network to evaluate (only forwardBatch is used, so it must not be trained concurrently)
+    /// @return Cross entropy loss, accuracy, top-k accuracy and confusion matrix
+    EvaluationMetrics evaluate(const MLP& mlp) const;
+
+    /// @brief Snapshots the network and evaluates the copy in the background so training can keep going
+    /// @param mlp Network to snapshot
+    /// @return Future holding the metrics (the evaluator must outlive it)
+    std::future<EvaluationMetrics> evaluateAsync(const MLP& mlp) const;
+
+    size_t getSampleCount() const { return labels.size(); }
+    size_t getTopK() const { return topK; }
+};
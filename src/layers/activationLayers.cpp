@@ -1,4 +1,5 @@
 #include "layers/activationLayers.hpp"
+#include "math/fastMath.hpp"
 #include <cmath>
 
 Eigen::VectorXf ReLULayer::forward(const Eigen::VectorXf& input, bool cacheEnabled)
@@ -19,6 +20,19 @@ Eigen::VectorXf ReLULayer::backward(const Eigen::VectorXf& outputGradient, float
     return outputGradient.cwiseProduct(cachedDerivatives);
 }
 
+void ReLULayer::forwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& input, Eigen::MatrixXf& output) const
+{
+    output.resize(input.rows(), input.cols());
+    output.noalias() = input.cwiseMax(0.0f);
+}
+
+const Eigen::MatrixXf& ReLULayer::forwardBatchCached(const Eigen::Ref<const Eigen::MatrixXf>& input)
+{
+    forwardBatch(input, cachedBatchOutput);
+    cachedBatchDerivatives = (input.array() > 0.0f).cast<float>();
+    return cachedBatchOutput;
+}
+
 Eigen::VectorXf LinearLayer::forward(const Eigen::VectorXf& input, bool cacheEnabled)
 {
     cachedOutput = input;
@@ -37,13 +51,30 @@ Eigen::VectorXf LinearLayer::backward(const Eigen::VectorXf& outputGradient, flo
     return outputGradient;
 }
 
+void LinearLayer::forwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& input, Eigen::MatrixXf& output) const
+{
+    output.resize(input.rows(), input.cols());
+    output = input;
+}
+
+const Eigen::MatrixXf& LinearLayer::forwardBatchCached(const Eigen::Ref<const Eigen::MatrixXf>& input)
+{
+    forwardBatch(input, cachedBatchOutput);
+    return cachedBatchOutput;
+}
+
+void LinearLayer::backwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& outputGradient, Eigen::MatrixXf& inputGradient) const
+{
+    inputGradient = outputGradient;
+}
+
 Eigen::VectorXf SoftmaxLayer::forward(const Eigen::VectorXf& input, bool cacheEnabled)
 {
     // Subtract max before exp for numerical stability
     float maxInput = input.maxCoeff();
-    Eigen::VectorXf exps = (input.array() - maxInput).exp();
-    float sumExps = exps.sum();
-    cachedOutput = exps / sumExps;
+    cachedOutput = input.array() - maxInput;
+    fastMath::exp(cachedOutput.data(), cachedOutput.data(), cachedOutput.size());
+    cachedOutput /= cachedOutput.sum();
     
     if (cacheEnabled)
     {
@@ -59,4 +90,198 @@ Eigen::VectorXf SoftmaxLayer::backward(const Eigen::VectorXf& outputGradient, fl
 {
     float dotProduct = cachedDerivatives.dot(outputGradient);
     return (cachedDerivatives.array() * (outputGradient.array() - dotProduct)).matrix();
+}
+
+void SoftmaxLayer::forwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& input, Eigen::MatrixXf& output) const
+{
+    output.resize(input.rows(), input.cols());
+
+    // Column by column to avoid allocating temporaries for the max and sum rows
+    for (Eigen::Index c = 0; c < input.cols(); ++c)
+    {
+        output.col(c) = input.col(c).array() - input.col(c).maxCoeff();
+    }
+
+    // Single exp pass over the whole batch
+    fastMath::exp(output.data(), output.data(), output.size());
+
+    for (Eigen::Index c = 0; c < output.cols(); ++c)
+    {
+        output.col(c) /= output.col(c).sum();
+    }
+}
+
+const Eigen::MatrixXf& SoftmaxLayer::forwardBatchCached(const Eigen::Ref<const Eigen::MatrixXf>& input)
+{
+    // Like the single sample pass, the backward pass only needs the output
+    forwardBatch(input, cachedBatchOutput);
+    return cachedBatchOutput;
+}
+
+void SoftmaxLayer::backwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& outputGradient, Eigen::MatrixXf& inputGradient) const
+{
+    inputGradient.resize(outputGradient.rows(), outputGradient.cols());
+
+    for (Eigen::Index c = 0; c < outputGradient.cols(); ++c)
+    {
+        float dotProduct = cachedBatchOutput.col(c).dot(outputGradient.col(c));
+        inputGradient.col(c) = (cachedBatchOutput.col(c).array() * (outputGradient.col(c).array() - dotProduct)).matrix();
+    }
+}
+
+Eigen::VectorXf SigmoidLayer::forward(const Eigen::VectorXf& input, bool cacheEnabled)
+{
+    cachedOutput.resize(input.size());
+    fastMath::sigmoid(input.data(), cachedOutput.data(), input.size());
+
+    if (cacheEnabled)
+    {
+        cachedInput = input;
+        // s'(x) = s(x) * (1 - s(x))
+        cachedDerivatives = cachedOutput.array() * (1.0f - cachedOutput.array());
+    }
+
+    return cachedOutput;
+}
+
+Eigen::VectorXf SigmoidLayer::backward(const Eigen::VectorXf& outputGradient, float learningRate)
+{
+    return outputGradient.cwiseProduct(cachedDerivatives);
+}
+
+void SigmoidLayer::forwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& input, Eigen::MatrixXf& output) const
+{
+    output.resize(input.rows(), input.cols());
+    output = input;
+    fastMath::sigmoid(output.data(), output.data(), output.size());
+}
+
+const Eigen::MatrixXf& SigmoidLayer::forwardBatchCached(const Eigen::Ref<const Eigen::MatrixXf>& input)
+{
+    forwardBatch(input, cachedBatchOutput);
+    cachedBatchDerivatives = cachedBatchOutput.array() * (1.0f - cachedBatchOutput.array());
+    return cachedBatchOutput;
+}
+
+Eigen::VectorXf TanhLayer::forward(const Eigen::VectorXf& input, bool cacheEnabled)
+{
+    cachedOutput.resize(input.size());
+    fastMath::tanh(input.data(), cachedOutput.data(), input.size());
+
+    if (cacheEnabled)
+    {
+        cachedInput = input;
+        // tanh'(x) = 1 - tanh(x)^2
+        cachedDerivatives = 1.0f - cachedOutput.array().square();
+    }
+
+    return cachedOutput;
+}
+
+Eigen::VectorXf TanhLayer::backward(const Eigen::VectorXf& outputGradient, float learningRate)
+{
+    return outputGradient.cwiseProduct(cachedDerivatives);
+}
+
+void TanhLayer::forwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& input, Eigen::MatrixXf& output) const
+{
+    output.resize(input.rows(), input.cols());
+    output = input;
+    fastMath::tanh(output.data(), output.data(), output.size());
+}
+
+const Eigen::MatrixXf& TanhLayer::forwardBatchCached(const Eigen::Ref<const Eigen::MatrixXf>& input)
+{
+    forwardBatch(input, cachedBatchOutput);
+    cachedBatchDerivatives = 1.0f - cachedBatchOutput.array().square();
+    return cachedBatchOutput;
+}
+
+Eigen::VectorXf GELULayer::forward(const Eigen::VectorXf& input, bool cacheEnabled)
+{
+    const float invSqrt2 = 0.70710678118654752f;
+    const float invSqrt2Pi = 0.39894228040143268f;
+
+    // cachedOutput first holds the normal CDF: Phi(x) = 0.5 * (1 + erf(x / sqrt(2)))
+    cachedOutput = input * invSqrt2;
+    fastMath::erf(cachedOutput.data(), cachedOutput.data(), cachedOutput.size());
+    cachedOutput.array() = 0.5f * (1.0f + cachedOutput.array());
+
+    if (cacheEnabled)
+    {
+        cachedInput = input;
+        // GELU'(x) = Phi(x) + x * phi(x), where phi(x) = exp(-x^2 / 2) / sqrt(2 * pi)
+        cachedDerivatives = -0.5f * input.array().square();
+        fastMath::exp(cachedDerivatives.data(), cachedDerivatives.data(), cachedDerivatives.size());
+        cachedDerivatives.array() = cachedOutput.array() + invSqrt2Pi * input.array() * cachedDerivatives.array();
+    }
+
+    // GELU(x) = x * Phi(x)
+    cachedOutput.array() *= input.array();
+
+    return cachedOutput;
+}
+
+Eigen::VectorXf GELULayer::backward(const Eigen::VectorXf& outputGradient, float learningRate)
+{
+    return outputGradient.cwiseProduct(cachedDerivatives);
+}
+
+void GELULayer::forwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& input, Eigen::MatrixXf& output) const
+{
+    const float invSqrt2 = 0.70710678118654752f;
+
+    output.resize(input.rows(), input.cols());
+    output = input * invSqrt2;
+    fastMath::erf(output.data(), output.data(), output.size());
+    output.array() = 0.5f * input.array() * (1.0f + output.array());
+}
+
+const Eigen::MatrixXf& GELULayer::forwardBatchCached(const Eigen::Ref<const Eigen::MatrixXf>& input)
+{
+    const float invSqrt2 = 0.70710678118654752f;
+    const float invSqrt2Pi = 0.39894228040143268f;
+
+    // Same steps as the single sample pass: Phi(x) in the output, then phi(x) in the derivatives
+    cachedBatchOutput = input * invSqrt2;
+    fastMath::erf(cachedBatchOutput.data(), cachedBatchOutput.data(), cachedBatchOutput.size());
+    cachedBatchOutput.array() = 0.5f * (1.0f + cachedBatchOutput.array());
+
+    cachedBatchDerivatives = -0.5f * input.array().square();
+    fastMath::exp(cachedBatchDerivatives.data(), cachedBatchDerivatives.data(), cachedBatchDerivatives.size());
+    cachedBatchDerivatives.array() = cachedBatchOutput.array() + invSqrt2Pi * input.array() * cachedBatchDerivatives.array();
+
+    cachedBatchOutput.array() *= input.array();
+    return cachedBatchOutput;
+}
+
+Eigen::VectorXf LeakyReLULayer::forward(const Eigen::VectorXf& input, bool cacheEnabled)
+{
+    cachedOutput = (input.array() > 0.0f).select(input, alpha * input);
+
+    if (cacheEnabled)
+    {
+        cachedInput = input;
+        cachedDerivatives = (input.array() > 0.0f).select(Eigen::VectorXf::Ones(input.size()), alpha);
+    }
+
+    return cachedOutput;
+}
+
+Eigen::VectorXf LeakyReLULayer::backward(const Eigen::VectorXf& outputGradient, float learningRate)
+{
+    return outputGradient.cwiseProduct(cachedDerivatives);
+}
+
+void LeakyReLULayer::forwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& input, Eigen::MatrixXf& output) const
+{
+    output.resize(input.rows(), input.cols());
+    output = (input.array() > 0.0f).select(input, alpha * input);
+}
+
+const Eigen::MatrixXf& LeakyReLULayer::forwardBatchCached(const Eigen::Ref<const Eigen::MatrixXf>& input)
+{
+    forwardBatch(input, cachedBatchOutput);
+    cachedBatchDerivatives = (input.array() > 0.0f).select(Eigen::MatrixXf::Ones(input.rows(), input.cols()), alpha);
+    return cachedBatchOutput;
 }
\ No newline at end of file
@@ -11,10 +11,28 @@ protected:
     Eigen::VectorXf cachedOutput;
     Eigen::VectorXf cachedDerivatives;
 
+    // Batch caches, filled by forwardBatchCached
+    Eigen::MatrixXf cachedBatchOutput;
+    Eigen::MatrixXf cachedBatchDerivatives;
+
 public:
     virtual ~ActivationLayer() = default;
 
     const Eigen::VectorXf& getOutput() const override { return cachedOutput; }
+
+    /// @brief Batched forward pass for training, caches the derivatives for backwardBatch
+    /// @param input Input matrix, one sample per column
+    /// @return Output matrix, one sample per column (the layer's batch cache)
+    virtual const Eigen::MatrixXf& forwardBatchCached(const Eigen::Ref<const Eigen::MatrixXf>& input) = 0;
+
+    /// @brief Batched backward pass using the derivatives cached by forwardBatchCached
+    /// @param outputGradient Gradient from the next layer (dc/da), one sample per column
+    /// @param inputGradient Gradient to pass to the previous layer (dc/da_prev), resized if needed
+    virtual void backwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& outputGradient, Eigen::MatrixXf& inputGradient) const
+    {
+        inputGradient.resize(outputGradient.rows(), outputGradient.cols());
+        inputGradient.noalias() = outputGradient.cwiseProduct(cachedBatchDerivatives);
+    }
 };
 
 class ReLULayer : public ActivationLayer
@@ -22,6 +40,9 @@ class ReLULayer : public ActivationLayer
 public:
     Eigen::VectorXf forward(const Eigen::VectorXf& input, bool cacheEnabled = false) override;
     Eigen::VectorXf backward(const Eigen::VectorXf& outputGradient, float learningRate) override;
+    void forwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& input, Eigen::MatrixXf& output) const override;
+    const Eigen::MatrixXf& forwardBatchCached(const Eigen::Ref<const Eigen::MatrixXf>& input) override;
+    std::unique_ptr<Layer> clone() const override { return std::make_unique<ReLULayer>(*this); }
     size_t getOutputSize() const override { return cachedOutput.size(); }
 };
 
@@ -30,6 +51,10 @@ class LinearLayer : public ActivationLayer
 public:
     Eigen::VectorXf forward(const Eigen::VectorXf& input, bool cacheEnabled = false) override;
     Eigen::VectorXf backward(const Eigen::VectorXf& outputGradient, float learningRate) override;
+    void forwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& input, Eigen::MatrixXf& output) const override;
+    const Eigen::MatrixXf& forwardBatchCached(const Eigen::Ref<const Eigen::MatrixXf>& input) override;
+    void backwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& outputGradient, Eigen::MatrixXf& inputGradient) const override;
+    std::unique_ptr<Layer> clone() const override { return std::make_unique<LinearLayer>(*this); }
     size_t getOutputSize() const override { return cachedOutput.size(); }
 };
 
@@ -38,5 +63,59 @@ class SoftmaxLayer : public ActivationLayer
 public:
     Eigen::VectorXf forward(const Eigen::VectorXf& input, bool cacheEnabled = false) override;
     Eigen::VectorXf backward(const Eigen::VectorXf& outputGradient, float learningRate) override;
+    void forwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& input, Eigen::MatrixXf& output) const override;
+    const Eigen::MatrixXf& forwardBatchCached(const Eigen::Ref<const Eigen::MatrixXf>& input) override;
+    void backwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& outputGradient, Eigen::MatrixXf& inputGradient) const override;
+    std::unique_ptr<Layer> clone() const override { return std::make_unique<SoftmaxLayer>(*this); }
+    size_t getOutputSize() const override { return cachedOutput.size(); }
+};
+
+class SigmoidLayer : public ActivationLayer
+{
+public:
+    Eigen::VectorXf forward(const Eigen::VectorXf& input, bool cacheEnabled = false) override;
+    Eigen::VectorXf backward(const Eigen::VectorXf& outputGradient, float learningRate) override;
+    void forwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& input, Eigen::MatrixXf& output) const override;
+    const Eigen::MatrixXf& forwardBatchCached(const Eigen::Ref<const Eigen::MatrixXf>& input) override;
+    std::unique_ptr<Layer> clone() const override { return std::make_unique<SigmoidLayer>(*this); }
+    size_t getOutputSize() const override { return cachedOutput.size(); }
+};
+
+class TanhLayer : public ActivationLayer
+{
+public:
+    Eigen::VectorXf forward(const Eigen::VectorXf& input, bool cacheEnabled = false) override;
+    Eigen::VectorXf backward(const Eigen::VectorXf& outputGradient, float learningRate) override;
+    void forwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& input, Eigen::MatrixXf& output) const override;
+    const Eigen::MatrixXf& forwardBatchCached(const Eigen::Ref<const Eigen::MatrixXf>& input) override;
+    std::unique_ptr<Layer> clone() const override { return std::make_unique<TanhLayer>(*this); }
+    size_t getOutputSize() const override { return cachedOutput.size(); }
+};
+
+class GELULayer : public ActivationLayer
+{
+public:
+    Eigen::VectorXf forward(const Eigen::VectorXf& input, bool cacheEnabled = false) override;
+    Eigen::VectorXf backward(const Eigen::VectorXf& outputGradient, float learningRate) override;
+    void forwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& input, Eigen::MatrixXf& output) const override;
+    const Eigen::MatrixXf& forwardBatchCached(const Eigen::Ref<const Eigen::MatrixXf>& input) override;
+    std::unique_ptr<Layer> clone() const override { return std::make_unique<GELULayer>(*this); }
+    size_t getOutputSize() const override { return cachedOutput.size(); }
+};
+
+class LeakyReLULayer : public ActivationLayer
+{
+private:
+    float alpha;
+
+public:
+    /// @param alpha Slope for negative inputs
+    LeakyReLULayer(float alpha = 0.01f) : alpha(alpha) {}
+
+    Eigen::VectorXf forward(const Eigen::VectorXf& input, bool cacheEnabled = false) override;
+    Eigen::VectorXf backward(const Eigen::VectorXf& outputGradient, float learningRate) override;
+    void forwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& input, Eigen::MatrixXf& output) const override;
+    const Eigen::MatrixXf& forwardBatchCached(const Eigen::Ref<const Eigen::MatrixXf>& input) override;
+    std::unique_ptr<Layer> clone() const override { return std::make_unique<LeakyReLULayer>(*this); }
     size_t getOutputSize() const override { return cachedOutput.size(); }
 };
\ No newline at end of file
@@ -59,6 +59,23 @@ Eigen::VectorXf DenseLayer::backward(const Eigen::VectorXf& outputGradient, floa
     return inputGradient;
 }
 
+void DenseLayer::forwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& input, Eigen::MatrixXf& output) const
+{
+    if (input.rows() != static_cast<Eigen::Index>(neurons[0].inputSize))
+    {
+        throw std::invalid_argument("Input size mismatch");
+    }
+
+    output.resize(neurons.size(), input.cols());
+
+    // One row per neuron: z = w^T * X + b for every sample of the batch at once
+    for (size_t j = 0; j < neurons.size(); ++j)
+    {
+        output.row(j).noalias() = neurons[j].getWeights().transpose() * input;
+        output.row(j).array() += neurons[j].getBias();
+    }
+}
+
 const Eigen::VectorXf& DenseLayer::getWeights(size_t neuronIdx) const
 {
     return neurons[neuronIdx].getWeights();
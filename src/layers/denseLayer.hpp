@@ -18,6 +18,8 @@ public:
 
     Eigen::VectorXf forward(const Eigen::VectorXf& input, bool cacheEnabled = false) override;
     Eigen::VectorXf backward(const Eigen::VectorXf& outputGradient, float learningRate) override;
+    void forwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& input, Eigen::MatrixXf& output) const override;
+    std::unique_ptr<Layer> clone() const override { return std::make_unique<DenseLayer>(*this); }
 
     size_t getOutputSize() const override { return neurons.size(); }
     const Eigen::VectorXf& getOutput() const override { return cachedOutput; }
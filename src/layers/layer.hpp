@@ -20,6 +20,14 @@ public:
     /// @return Gradient to pass to previous layer (dc/da_prev)
     virtual Eigen::VectorXf backward(const Eigen::VectorXf& outputGradient, float learningRate) = 0;
 
+    /// @brief Batched inference pass, does not touch the layer caches so it is safe to call from several threads
+    /// @param input Input matrix, one sample per column
+    /// @param output Output matrix, one sample per column (resized if needed)
+    virtual void forwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& input, Eigen::MatrixXf& output) const = 0;
+
+    /// @brief Deep copy of the layer (used to snapshot a network)
+    virtual std::unique_ptr<Layer> clone() const = 0;
+
     virtual size_t getOutputSize() const = 0;
 
     virtual const Eigen::VectorXf& getOutput() const = 0;
@@ -6,12 +6,15 @@
 #include <cstdint>
 #include <algorithm>
 #include <random>
+#include <chrono>
+#include <future>
 
 #include "perceptron/perceptron.hpp"
 #include "mlp/mlp.hpp"
 #include "layers/denseLayer.hpp"
 #include "layers/activationLayers.hpp"
 #include "lossFunctions/lossFunctions.hpp"
+#include "evaluation/evaluator.hpp"
 
 #pragma region MNIST_PARSING
 // NOTE: MNIST parsing code is AI-generated
@@ -117,8 +120,8 @@ void trainMNISTDigitClassifier()
         int imagesPerEpoch = 500;
         auto trainImages = loadMNISTImages(trainImagesPath, imagesPerEpoch);
         auto trainLabels = loadMNISTLabels(trainLabelsPath, imagesPerEpoch);
-        auto testImages = loadMNISTImages(testImagesPath, 100);
-        auto testLabels = loadMNISTLabels(testLabelsPath, 100);
+        auto testImages = loadMNISTImages(testImagesPath);
+        auto testLabels = loadMNISTLabels(testLabelsPath);
 
         std::cout << "Loaded " << trainImages.size() << " training samples" << std::endl;
         std::cout << "Loaded " << testImages.size() << " test samples" << std::endl;
@@ -131,10 +134,22 @@ void trainMNISTDigitClassifier()
         layers.push_back(std::make_unique<SoftmaxLayer>());
 
         MLP mlp(std::move(layers));
+        Evaluator evaluator(testImages, testLabels, 10);
 
         float learningRate = 0.05f;
         int epochs = 25;
 
+        // Evaluate a snapshot on the test set every N epochs in the background
+        int evalInterval = 5;
+        std::future<EvaluationMetrics> pendingEval;
+        int pendingEvalEpoch = -1;
+        auto printPendingEval = [&]()
+        {
+            EvaluationMetrics metrics = pendingEval.get();
+            std::cout << "  [eval @ epoch " << pendingEvalEpoch << "] test accuracy: " << 100.0f * metrics.accuracy()
+                      << "%, test avg CrossEntropy: " << metrics.averageLoss() << std::endl;
+        };
+
         std::cout << "\nTraining MLP for digit classification..." << std::endl;
         std::cout << "Learning Rate: " << learningRate << ", Epochs: " << epochs << std::endl;
         std::cout << "Epoch\t\tAvg CrossEntropy\tAccuracy" << std::endl;
@@ -180,6 +195,21 @@ void trainMNISTDigitClassifier()
             float avgLoss = totalLoss / totalProcessed;
             float accuracy = (100.0f * correctPredictions) / totalProcessed;
             std::cout << epoch << "\t\t" << std::fixed << avgLoss << "\t" << accuracy << "%" << std::endl;
+
+            if ((epoch + 1) % evalInterval == 0)
+            {
+                if (pendingEval.valid())
+                {
+                    printPendingEval();
+                }
+                pendingEval = evaluator.evaluateAsync(mlp);
+                pendingEvalEpoch = epoch;
+            }
+        }
+
+        if (pendingEval.valid())
+        {
+            printPendingEval();
         }
 
         // Test on test set
@@ -187,43 +217,34 @@ void trainMNISTDigitClassifier()
         std::cout << "Testing on Test Set" << std::endl;
         std::cout << "========================================" << std::endl;
 
-        int testCorrect = 0;
-        float testLoss = 0.0f;
-        for (int i = 0; i < testImages.size(); ++i) 
+        auto evalStart = std::chrono::steady_clock::now();
+        EvaluationMetrics metrics = evaluator.evaluate(mlp);
+        auto evalEnd = std::chrono::steady_clock::now();
+
+        // Print first predictions
+        for (int i = 0; i < 20 && i < testImages.size(); ++i) 
         {
-            Eigen::VectorXf output = mlp.forward(testImages[i], false);
-            int predicted = getPredictedDigit(output);
+            int predicted = metrics.predictions[i];
             int actual = testLabels[i];
-            Eigen::VectorXf target = labelToOneHot(actual, 10);
-            CrossEntropy lossFunc;
-            testLoss += lossFunc.loss(output, target);
-
+            std::cout << "Sample " << i << ": Predicted = " << predicted 
+                      << ", Actual = " << actual;
             if (predicted == actual) 
             {
-                testCorrect++;
+                std::cout << " [CORRECT]" << std::endl;
             }
-
-            // Print first predictions
-            if (i < 20) 
+            else
             {
-                std::cout << "Sample " << i << ": Predicted = " << predicted 
-                          << ", Actual = " << actual;
-                if (predicted == actual) 
-                {
-                    std::cout << " [CORRECT]" << std::endl;
-                }
-                else
-                {
-                    std::cout << " [WRONG]" << std::endl;
-                }
+                std::cout << " [WRONG]" << std::endl;
             }
         }
 
-        float testAccuracy = (100.0f * testCorrect) / testImages.size();
-        float avgTestLoss = testLoss / testImages.size();
-        std::cout << "\nTest Accuracy: " << testAccuracy << "% (" << testCorrect 
-                  << "/" << testImages.size() << ")" << std::endl;
-        std::cout << "Test Avg CrossEntropy: " << avgTestLoss << std::endl;
+        std::cout << "\nTest Accuracy: " << 100.0f * metrics.accuracy() << "% (" << metrics.correct 
+                  << "/" << metrics.sampleCount << ")" << std::endl;
+        std::cout << "Test Top-" << evaluator.getTopK() << " Accuracy: " << 100.0f * metrics.topKAccuracy() << "%" << std::endl;
+        std::cout << "Test Avg CrossEntropy: " << metrics.averageLoss() << std::endl;
+        std::cout << "Evaluation time: " << std::chrono::duration<float, std::milli>(evalEnd - evalStart).count() << " ms" << std::endl;
+        std::cout << "\nConfusion matrix (rows = actual, columns = predicted):" << std::endl;
+        std::cout << metrics.confusionMatrix << std::endl;
     }
     catch (const std::exception& e)
     {
@@ -0,0 +1,125 @@
+#include "math/fastMath.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+    // Cephes expf: e^x = 2^n * e^r with |r| <= ln(2)/2, e^r from a degree 7 polynomial
+    inline float expKernel(float x)
+    {
+        const float log2e = 1.44269504088896341f;
+        const float ln2Hi = 0.693359375f;
+        const float ln2Lo = -2.12194440e-4f;
+        // Adding then subtracting 1.5 * 2^23 rounds to nearest without a call to round()
+        const float roundMagic = 12582912.0f;
+
+        x = std::min(std::max(x, -87.3f), 88.3f);
+
+        float n = (x * log2e + roundMagic) - roundMagic;
+        float r = x - n * ln2Hi - n * ln2Lo;
+
+        float p = 1.9875691500e-4f;
+        p = p * r + 1.3981999507e-3f;
+        p = p * r + 8.3334519073e-3f;
+        p = p * r + 4.1665795894e-2f;
+        p = p * r + 1.6666665459e-1f;
+        p = p * r + 5.0000001201e-1f;
+        p = p * r * r + r + 1.0f;
+
+        // Build 2^n directly in the exponent bits
+        int32_t bits = (static_cast<int32_t>(n) + 127) << 23;
+        float scale;
+        std::memcpy(&scale, &bits, sizeof(scale));
+        return p * scale;
+    }
+
+    inline float tanhKernel(float x)
+    {
+        float absX = std::fabs(x);
+
+        // Small inputs: Cephes tanhf odd polynomial, avoids the cancellation in 1 - 2 / (e^2x + 1)
+        float z = x * x;
+        float p = -5.70498872745e-3f;
+        p = p * z + 2.06390887954e-2f;
+        p = p * z - 5.37397155531e-2f;
+        p = p * z + 1.33314422036e-1f;
+        p = p * z - 3.33332819422e-1f;
+        float small = x + x * z * p;
+
+        float large = 1.0f - 2.0f / (expKernel(2.0f * absX) + 1.0f);
+        large = std::copysign(large, x);
+
+        return absX < 0.625f ? small : large;
+    }
+
+    inline float sigmoidKernel(float x)
+    {
+        return 1.0f / (1.0f + expKernel(-x));
+    }
+
+    inline float erfKernel(float x)
+    {
+        float absX = std::fabs(x);
+
+        // Small inputs: Cephes erff odd polynomial, avoids the cancellation in 1 - p * e^-x^2 near 0
+        float z = x * x;
+        float q = 7.853861353153693e-5f;
+        q = q * z - 8.010193625184903e-4f;
+        q = q * z + 5.188327685732524e-3f;
+        q = q * z - 2.685381193529856e-2f;
+        q = q * z + 1.128358514861418e-1f;
+        q = q * z - 3.761262582423300e-1f;
+        q = q * z + 1.128379165726710e+0f;
+        float small = x * q;
+
+        float t = 1.0f / (1.0f + 0.3275911f * absX);
+
+        float p = 1.061405429f;
+        p = p * t - 1.453152027f;
+        p = p * t + 1.421413741f;
+        p = p * t - 0.284496736f;
+        p = p * t + 0.254829592f;
+        p = p * t;
+
+        float large = std::copysign(1.0f - p * expKernel(-absX * absX), x);
+
+        return absX < 1.0f ? small : large;
+    }
+}
+
+namespace fastMath
+{
+    void exp(const float* input, float* output, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            output[i] = expKernel(input[i]);
+        }
+    }
+
+    void tanh(const float* input, float* output, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            output[i] = tanhKernel(input[i]);
+        }
+    }
+
+    void sigmoid(const float* input, float* output, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            output[i] = sigmoidKernel(input[i]);
+        }
+    }
+
+    void erf(const float* input, float* output, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            output[i] = erfKernel(input[i]);
+        }
+    }
+}
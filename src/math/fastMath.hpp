@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+
+// Vectorizable elementwise math kernels working on contiguous float buffers.
+// Branch-free polynomial approximations so the compiler can turn each loop into SIMD code.
+// Every kernel accepts input == output to work in place.
+namespace fastMath
+{
+    /// @brief e^x, max relative error ~2e-7 on [-87, 88] (inputs are clamped to that range)
+    void exp(const float* input, float* output, size_t count);
+
+    /// @brief tanh(x), max absolute error ~3e-7
+    void tanh(const float* input, float* output, size_t count);
+
+    /// @brief 1 / (1 + e^-x), max absolute error ~2e-7
+    void sigmoid(const float* input, float* output, size_t count);
+
+    /// @brief erf(x), max relative error ~3e-7 for |x| < 1, max absolute error ~6e-7 elsewhere (Abramowitz & Stegun 7.1.26)
+    void erf(const float* input, float* output, size_t count);
+}
@@ -45,4 +45,28 @@ void MLP::backward(const Eigen::VectorXf& expectedOutput, float learningRate, co
     {
         dc_da = layers[l]->backward(dc_da, learningRate);
     }
+}
+
+const Eigen::MatrixXf& MLP::forwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& inputs, std::vector<Eigen::MatrixXf>& workspace) const
+{
+    workspace.resize(layers.size());
+
+    layers[0]->forwardBatch(inputs, workspace[0]);
+    for (size_t i = 1; i < layers.size(); ++i)
+    {
+        layers[i]->forwardBatch(workspace[i - 1], workspace[i]);
+    }
+
+    return workspace.back();
+}
+
+MLP MLP::clone() const
+{
+    std::vector<std::unique_ptr<Layer>> copies;
+    copies.reserve(layers.size());
+    for (const auto& layer : layers)
+    {
+        copies.push_back(layer->clone());
+    }
+    return MLP(std::move(copies));
 }
\ No newline at end of file
@@ -27,6 +27,15 @@ public:
     /// @param lossFunc Loss function to use
     void backward(const Eigen::VectorXf& expectedOutput, float learningRate, const LossFunction& lossFunc);
 
+    /// @brief Batched inference pass, leaves the layer caches untouched so it can run concurrently
+    /// @param inputs Input matrix, one sample per column
+    /// @param workspace Per-caller buffers holding each layer's output, reused across calls to avoid allocations
+    /// @return Output matrix, one sample per column (stored in the workspace)
+    const Eigen::MatrixXf& forwardBatch(const Eigen::Ref<const Eigen::MatrixXf>& inputs, std::vector<Eigen::MatrixXf>& workspace) const;
+
+    /// @brief Deep copy of the network, used to evaluate a snapshot while training continues
+    MLP clone() const;
+
     size_t getLayerCount() const { return layers.size(); }
 
     Layer* getLayer(size_t idx) { return idx < layers.size() ? layers[idx].get() : nullptr; }
@@ -0,0 +1,163 @@
+#include "math/fastMath.hpp"
+#include "layers/activationLayers.hpp"
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+// Accuracy and throughput of the fastMath kernels against std::, plus gradient checks of the activation layers.
+// Returns a non-zero exit code if any error bound stated in fastMath.hpp is exceeded.
+
+namespace
+{
+    typedef void (*Kernel)(const float*, float*, size_t);
+
+    const size_t sampleCount = 1 << 22;
+    const int timingRepeats = 10;
+
+    int failures = 0;
+
+    void expectBelow(const std::string& name, double error, double bound)
+    {
+        bool ok = error <= bound;
+        std::cout << (ok ? "[PASS] " : "[FAIL] ") << name << ": " << error << " (bound " << bound << ")" << std::endl;
+        if (!ok)
+        {
+            failures++;
+        }
+    }
+
+    std::vector<float> linspace(float lo, float hi, size_t count)
+    {
+        std::vector<float> values(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            values[i] = static_cast<float>(lo + (static_cast<double>(hi) - lo) * i / (count - 1));
+        }
+        return values;
+    }
+
+    /// @brief Sweeps a kernel over [lo, hi] and returns the max error against a double precision reference
+    double maxError(Kernel kernel, const std::function<double(double)>& reference, float lo, float hi, bool relative)
+    {
+        std::vector<float> input = linspace(lo, hi, sampleCount);
+        std::vector<float> output(sampleCount);
+        kernel(input.data(), output.data(), sampleCount);
+
+        double worst = 0.0;
+        for (size_t i = 0; i < sampleCount; ++i)
+        {
+            double expected = reference(input[i]);
+            double error = std::fabs(output[i] - expected);
+            if (relative)
+            {
+                error /= std::fabs(expected);
+            }
+            worst = std::max(worst, error);
+        }
+        return worst;
+    }
+
+    double elementsPerSecond(const std::function<void(const float*, float*, size_t)>& kernel, float lo, float hi)
+    {
+        std::vector<float> input = linspace(lo, hi, sampleCount);
+        std::vector<float> output(sampleCount);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < timingRepeats; ++r)
+        {
+            kernel(input.data(), output.data(), sampleCount);
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        return static_cast<double>(sampleCount) * timingRepeats / std::chrono::duration<double>(end - start).count();
+    }
+
+    void benchmark(const std::string& name, Kernel kernel, float (*scalar)(float), float lo, float hi)
+    {
+        double fast = elementsPerSecond(kernel, lo, hi);
+        double reference = elementsPerSecond([scalar](const float* in, float* out, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                out[i] = scalar(in[i]);
+            }
+        }, lo, hi);
+
+        std::cout << "  " << name << ": " << fast / 1e6 << " Melem/s (std:: " << reference / 1e6 << " Melem/s)" << std::endl;
+    }
+
+    /// @brief Compares the layer gradients (single sample and batched) with central finite differences of w . f(x)
+    void checkGradient(const std::string& name, ActivationLayer& layer)
+    {
+        const int size = 16;
+        const float h = 1e-2f;
+
+        // Inputs stay at least 0.05 away from 0 so the finite differences never straddle the LeakyReLU kink
+        Eigen::VectorXf input(size);
+        Eigen::VectorXf weights(size);
+        for (int i = 0; i < size; ++i)
+        {
+            input[i] = -2.95f + 0.4f * i;
+            weights[i] = std::sin(1.0f + i);
+        }
+
+        layer.forward(input, true);
+        Eigen::VectorXf gradient = layer.backward(weights, 0.0f);
+
+        double worst = 0.0;
+        for (int i = 0; i < size; ++i)
+        {
+            Eigen::VectorXf plus = input;
+            Eigen::VectorXf minus = input;
+            plus[i] += h;
+            minus[i] -= h;
+            float numerical = (weights.dot(layer.forward(plus)) - weights.dot(layer.forward(minus))) / (2.0f * h);
+            worst = std::max(worst, static_cast<double>(std::fabs(numerical - gradient[i])));
+        }
+        expectBelow(name + " gradient vs finite differences", worst, 1e-3);
+
+        // The batched pass must give the same gradient for every column
+        Eigen::MatrixXf batchInput = input.replicate(1, 3);
+        Eigen::MatrixXf batchGradient;
+        layer.forwardBatchCached(batchInput);
+        layer.backwardBatch(weights.replicate(1, 3), batchGradient);
+        double batchError = (batchGradient.colwise() - gradient).cwiseAbs().maxCoeff();
+        expectBelow(name + " backwardBatch vs backward", batchError, 1e-6);
+    }
+}
+
+int main()
+{
+    std::cout << "Accuracy" << std::endl;
+    expectBelow("exp max rel error on [-87, 88]",
+                maxError(fastMath::exp, [](double x) { return std::exp(x); }, -87.0f, 88.0f, true), 2e-7);
+    expectBelow("tanh max abs error on [-10, 10]",
+                maxError(fastMath::tanh, [](double x) { return std::tanh(x); }, -10.0f, 10.0f, false), 3e-7);
+    expectBelow("sigmoid max abs error on [-30, 30]",
+                maxError(fastMath::sigmoid, [](double x) { return 1.0 / (1.0 + std::exp(-x)); }, -30.0f, 30.0f, false), 2e-7);
+    expectBelow("erf max abs error on [-6, 6]",
+                maxError(fastMath::erf, [](double x) { return std::erf(x); }, -6.0f, 6.0f, false), 6e-7);
+    expectBelow("erf max rel error on [-0.999, 0.999]",
+                maxError(fastMath::erf, [](double x) { return std::erf(x); }, -0.999f, 0.999f, true), 3e-7);
+
+    std::cout << "\nThroughput" << std::endl;
+    benchmark("exp", fastMath::exp, [](float x) { return std::exp(x); }, -87.0f, 88.0f);
+    benchmark("tanh", fastMath::tanh, [](float x) { return std::tanh(x); }, -10.0f, 10.0f);
+    benchmark("sigmoid", fastMath::sigmoid, [](float x) { return 1.0f / (1.0f + std::exp(-x)); }, -30.0f, 30.0f);
+    benchmark("erf", fastMath::erf, [](float x) { return std::erf(x); }, -6.0f, 6.0f);
+
+    std::cout << "\nGradients" << std::endl;
+    SigmoidLayer sigmoid;
+    TanhLayer tanh;
+    GELULayer gelu;
+    LeakyReLULayer leakyRelu;
+    checkGradient("Sigmoid", sigmoid);
+    checkGradient("Tanh", tanh);
+    checkGradient("GELU", gelu);
+    checkGradient("LeakyReLU", leakyRelu);
+
+    std::cout << "\n" << (failures == 0 ? "All tests passed" : std::to_string(failures) + " test(s) failed") << std::endl;
+    return failures == 0 ? 0 : 1;
+}